@@ -1,4 +1,22 @@
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BF_HAS_POSIX 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(BF_HAS_POSIX) && defined(__x86_64__) && defined(__linux__)
+#define BF_HAS_JIT 1
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -643,8 +661,740 @@ struct MachineExecuter<Machine<PRG, MEM, OUT>>
 
 //////////////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+// Runtime
+//
+// Same language as the Machine above, but executed at runtime on programs
+// that would be far too large to instantiate as templates. Cells wrap at 8
+// bits like MemStorageNS::Inc/Dec, and an unmatched bracket yields the same
+// "Error!" output as MchExecuterNs::InvalidMachine (checked up front instead
+// of when the bracket is reached). Unlike the Machine, ',' is supported; it
+// stores 0 once the input is exhausted.
+namespace RuntimeNS
+{
+    enum class OpKind : unsigned char
+    {
+        Add,   // arg: amount to add to the current cell (mod 256)
+        Move,  // arg: signed offset of the memory head
+        Clear, // [-] / [+] and friends
+        Print,
+        Read,
+        Open,  // arg: index of the matching Close
+        Close, // arg: index of the matching Open
+    };
+
+    struct Op
+    {
+        OpKind kind;
+        int arg;
+    };
+
+    using PutFn = void (*)(unsigned char);
+    using GetFn = unsigned char (*)();
+
+    // Program and input files. Regular program files are mapped in whole
+    // where mmap exists, regular input files window by window as ',' walks
+    // them (see IoNS::Refill). Anything else (pipes, FIFOs, ...), or a file
+    // that cannot be mapped, is read in whole for programs and streamed
+    // block by block for input.
+    namespace FileNS
+    {
+#ifdef BF_HAS_POSIX
+        using Stream = int;
+        static const Stream NoStream = -1;
+#else
+        using Stream = FILE *;
+        static const Stream NoStream = nullptr;
+#endif
+
+        struct File
+        {
+            const char *data;
+            size_t size;
+            bool mapped;
+            std::vector<char> copy;
+            Stream stream; // set when the file is streamed instead of loaded
+            bool windowed; // stream is a regular file to map window by window
+        };
+
+        // Returns the number of bytes read, 0 at end of file and -1 on error.
+        static ptrdiff_t ReadBlock(Stream stream, void *buf, size_t size)
+        {
+#ifdef BF_HAS_POSIX
+            ptrdiff_t n;
+            do
+                n = read(stream, buf, size);
+            while (n < 0 && errno == EINTR);
+            return n;
+#else
+            size_t n = fread(buf, 1, size, stream);
+            return n == 0 && ferror(stream) ? -1 : (ptrdiff_t)n;
+#endif
+        }
+
+        static bool ReadAll(Stream stream, File &file)
+        {
+            char block[1 << 16];
+            ptrdiff_t n;
+            while ((n = ReadBlock(stream, block, sizeof(block))) > 0)
+                file.copy.insert(file.copy.end(), block, block + n);
+            file.data = file.copy.data();
+            file.size = file.copy.size();
+            return n == 0;
+        }
+
+        // Wraps data that is already in memory, e.g. a fixed demo input.
+        static void FromMemory(const char *data, size_t size, File &file)
+        {
+            file.data = data;
+            file.size = size;
+            file.mapped = false;
+            file.stream = NoStream;
+            file.windowed = false;
+        }
+
+        static bool Open(const char *path, File &file, bool stream)
+        {
+            FromMemory("", 0, file);
+#ifdef BF_HAS_POSIX
+            int fd = open(path, O_RDONLY);
+            if (fd < 0)
+                return false;
+            struct stat st;
+            if (fstat(fd, &st) != 0)
+            {
+                close(fd);
+                return false;
+            }
+            if (!S_ISREG(st.st_mode))
+            {
+                if (stream)
+                {
+                    file.stream = fd;
+                    return true;
+                }
+                bool ok = ReadAll(fd, file);
+                close(fd);
+                return ok;
+            }
+            if (stream)
+            {
+                file.stream = fd;
+                file.windowed = true;
+                return true;
+            }
+            if (st.st_size > 0)
+            {
+                void *mem = MAP_FAILED;
+                if ((uintmax_t)st.st_size <= SIZE_MAX)
+                    mem = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mem == MAP_FAILED)
+                {
+                    bool ok = ReadAll(fd, file);
+                    close(fd);
+                    return ok;
+                }
+                madvise(mem, (size_t)st.st_size, MADV_SEQUENTIAL);
+                file.data = (const char *)mem;
+                file.size = (size_t)st.st_size;
+                file.mapped = true;
+            }
+            close(fd);
+            return true;
+#else
+            FILE *f = fopen(path, "rb");
+            if (f == nullptr)
+                return false;
+            if (stream)
+            {
+                file.stream = f;
+                return true;
+            }
+            bool ok = ReadAll(f, file);
+            fclose(f);
+            return ok;
+#endif
+        }
+
+        static void Close(File &file)
+        {
+#ifdef BF_HAS_POSIX
+            if (file.mapped)
+                munmap((void *)file.data, file.size);
+            if (file.stream != NoStream)
+                close(file.stream);
+#else
+            if (file.stream != NoStream)
+                fclose(file.stream);
+#endif
+            file.mapped = false;
+            file.stream = NoStream;
+        }
+    } // namespace FileNS
+
+    // Block buffered '.' and ','. State is global so the JIT can call plain
+    // function pointers.
+    namespace IoNS
+    {
+        static constexpr size_t BlockSize = 1 << 16;
+
+        static unsigned char outBuf[BlockSize];
+        static size_t outLen = 0;
+
+        static unsigned char inBuf[BlockSize];
+        static const unsigned char *inCur = inBuf;
+        static const unsigned char *inEnd = inBuf;
+        static bool inEof = false;
+#ifdef BF_HAS_POSIX
+        static FileNS::Stream inStream = STDIN_FILENO;
+#else
+        static FileNS::Stream inStream = stdin;
+#endif
+
+#ifdef BF_HAS_POSIX
+        // Only one window of a regular input file is mapped at a time, so
+        // memory use does not grow with the input.
+        static constexpr size_t WindowSize = 1 << 22;
+
+        static bool inWindowed = false;
+        static off_t inOffset = 0;
+        static off_t inSize = 0;
+        static void *inWindow = nullptr;
+        static size_t inWindowLen = 0;
+
+        static void UnmapWindow()
+        {
+            if (inWindow != nullptr)
+                munmap(inWindow, inWindowLen);
+            inWindow = nullptr;
+            inWindowLen = 0;
+        }
+
+        static bool MapWindow()
+        {
+            size_t len = inSize - inOffset < (off_t)WindowSize ? (size_t)(inSize - inOffset) : WindowSize;
+            void *mem = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, inStream, inOffset);
+            if (mem == MAP_FAILED)
+                return false;
+            madvise(mem, len, MADV_SEQUENTIAL);
+            inWindow = mem;
+            inWindowLen = len;
+            inCur = (const unsigned char *)mem;
+            inEnd = inCur + len;
+            inOffset += len;
+            return true;
+        }
+#endif
+
+        static void Flush()
+        {
+            if (outLen == 0)
+                return;
+            if (fwrite(outBuf, 1, outLen, stdout) != outLen || fflush(stdout) != 0)
+            {
+                perror("Cannot write output");
+                exit(1);
+            }
+            outLen = 0;
+        }
+
+        static void PutByte(unsigned char c)
+        {
+            if (outLen == BlockSize)
+                Flush();
+            outBuf[outLen++] = c;
+        }
+
+        // Pending output is flushed before blocking on the input stream so
+        // interactive programs still show their prompts.
+        // Once the end of input is seen it is remembered, later ',' do not
+        // touch the stream again.
+        static bool Refill()
+        {
+            if (inEof || inStream == FileNS::NoStream)
+                return false;
+#ifdef BF_HAS_POSIX
+            if (inWindowed)
+            {
+                UnmapWindow();
+                if (inOffset >= inSize)
+                {
+                    inEof = true;
+                    return false;
+                }
+                if (MapWindow())
+                    return true;
+                // Read the rest of the file instead
+                inWindowed = false;
+                if (lseek(inStream, inOffset, SEEK_SET) < 0)
+                {
+                    perror("Cannot read input");
+                    exit(1);
+                }
+            }
+#endif
+            Flush();
+            ptrdiff_t n = FileNS::ReadBlock(inStream, inBuf, BlockSize);
+            if (n < 0)
+            {
+                perror("Cannot read input");
+                exit(1);
+            }
+            inCur = inBuf;
+            inEnd = inBuf + n;
+            inEof = n == 0;
+            return !inEof;
+        }
+
+        static unsigned char GetByte()
+        {
+            if (inCur == inEnd && !Refill())
+                return 0;
+            return *inCur++;
+        }
+
+        // Back to stdin, dropping any state left by a previous input file.
+        static void ResetInput()
+        {
+#ifdef BF_HAS_POSIX
+            UnmapWindow();
+            inWindowed = false;
+            inOffset = 0;
+            inSize = 0;
+            inStream = STDIN_FILENO;
+#else
+            inStream = stdin;
+#endif
+            inCur = inEnd = inBuf;
+            inEof = false;
+        }
+
+        static void UseInput(const FileNS::File &file)
+        {
+            inStream = file.stream;
+            if (inStream != FileNS::NoStream)
+            {
+                inCur = inEnd = inBuf;
+#ifdef BF_HAS_POSIX
+                struct stat st;
+                inWindowed = file.windowed && fstat(inStream, &st) == 0;
+                inOffset = 0;
+                inSize = inWindowed ? st.st_size : 0;
+#endif
+                return;
+            }
+            inCur = (const unsigned char *)file.data;
+            inEnd = inCur + file.size;
+        }
+    } // namespace IoNS
+
+    // Like MemoryStorage the tape is unbounded in both directions. It starts
+    // with the head in the middle and Grow extends it towards whichever end
+    // the head crossed.
+    namespace TapeNS
+    {
+        static constexpr size_t InitialSize = 1 << 20;
+
+        struct Bounds
+        {
+            unsigned char *lo; // first cell
+            unsigned char *hi; // one past the last cell
+        };
+
+        static std::vector<unsigned char> cells;
+        static Bounds bounds;
+
+        // Returns the initial head.
+        static unsigned char *Init()
+        {
+            cells.assign(InitialSize, 0);
+            bounds = {cells.data(), cells.data() + cells.size()};
+            return cells.data() + InitialSize / 2;
+        }
+
+        // pos is the head relative to bounds.lo and lies outside the tape.
+        // Returns the head in the grown tape.
+        static unsigned char *Grow(ptrdiff_t pos)
+        {
+            size_t size = cells.size();
+            size_t need = pos < 0 ? (size_t)-pos : (size_t)pos - size + 1;
+            size_t extra = size;
+            while (extra < need)
+                extra *= 2;
+            size_t front = pos < 0 ? extra : 0;
+            try
+            {
+                std::vector<unsigned char> next(size + extra, 0);
+                memcpy(next.data() + front, cells.data(), size);
+                cells.swap(next);
+            }
+            catch (...)
+            {
+                IoNS::Flush();
+                fprintf(stderr, "Out of memory growing the tape\n");
+                exit(1);
+            }
+            bounds = {cells.data(), cells.data() + cells.size()};
+            return cells.data() + pos + front;
+        }
+    } // namespace TapeNS
+
+    enum class ParseResult
+    {
+        Ok,
+        Unmatched,
+        TooLarge,
+    };
+
+    // Op::arg and the JIT's rel32 jumps and imm32 moves bound the program:
+    // longer '>'/'<' runs are split and at most MaxOps ops are accepted
+    // (the JIT emits at most 30 bytes per op).
+    static constexpr int MaxMove = 1 << 30;
+    static constexpr size_t MaxOps = 1 << 26;
+
+    // Collapses runs of '+'/'-' and '>'/'<' into single ops and links every
+    // bracket to its match.
+    static ParseResult Parse(const char *src, size_t len, std::vector<Op> &ops)
+    {
+        std::vector<size_t> open;
+        const char *end = src + len;
+        for (const char *c = src; c != end; c++)
+        {
+            switch (*c)
+            {
+            case '+':
+            case '-':
+            {
+                unsigned char n = 0;
+                for (; c != end && (*c == '+' || *c == '-'); c++)
+                    n += *c == '+' ? 1 : -1;
+                c--;
+                if (n != 0)
+                    ops.push_back({OpKind::Add, n});
+                break;
+            }
+            case '>':
+            case '<':
+            {
+                int n = 0;
+                for (; c != end && (*c == '>' || *c == '<'); c++)
+                {
+                    n += *c == '>' ? 1 : -1;
+                    if (n == MaxMove || n == -MaxMove)
+                    {
+                        ops.push_back({OpKind::Move, n});
+                        n = 0;
+                    }
+                }
+                c--;
+                if (n != 0)
+                    ops.push_back({OpKind::Move, n});
+                break;
+            }
+            case '.':
+                ops.push_back({OpKind::Print, 0});
+                break;
+            case ',':
+                ops.push_back({OpKind::Read, 0});
+                break;
+            case '[':
+                open.push_back(ops.size());
+                ops.push_back({OpKind::Open, 0});
+                break;
+            case ']':
+            {
+                if (open.empty())
+                    return ParseResult::Unmatched;
+                size_t o = open.back();
+                open.pop_back();
+                // An odd step always reaches 0 modulo 256
+                if (ops.size() == o + 2 && ops[o + 1].kind == OpKind::Add && (ops[o + 1].arg & 1))
+                {
+                    ops.resize(o);
+                    ops.push_back({OpKind::Clear, 0});
+                    break;
+                }
+                ops[o].arg = (int)ops.size();
+                ops.push_back({OpKind::Close, (int)o});
+                break;
+            }
+            default:
+                break;
+            }
+            if (ops.size() > MaxOps)
+                return ParseResult::TooLarge;
+        }
+        return open.empty() ? ParseResult::Ok : ParseResult::Unmatched;
+    }
+
+    static void Interpret(const std::vector<Op> &ops, unsigned char *cell, PutFn put, GetFn get)
+    {
+        for (size_t pc = 0; pc < ops.size(); pc++)
+        {
+            const Op &op = ops[pc];
+            switch (op.kind)
+            {
+            case OpKind::Add:
+                *cell += (unsigned char)op.arg;
+                break;
+            case OpKind::Move:
+            {
+                ptrdiff_t pos = cell - TapeNS::bounds.lo + op.arg;
+                if (pos < 0 || pos >= TapeNS::bounds.hi - TapeNS::bounds.lo)
+                    cell = TapeNS::Grow(pos);
+                else
+                    cell = TapeNS::bounds.lo + pos;
+                break;
+            }
+            case OpKind::Clear:
+                *cell = 0;
+                break;
+            case OpKind::Print:
+                put(*cell);
+                break;
+            case OpKind::Read:
+                *cell = get();
+                break;
+            case OpKind::Open:
+                if (*cell == 0)
+                    pc = op.arg;
+                break;
+            case OpKind::Close:
+                if (*cell != 0)
+                    pc = op.arg;
+                break;
+            }
+        }
+    }
+
+#ifdef BF_HAS_JIT
+    namespace JitNS
+    {
+        using GrowFn = unsigned char *(*)(ptrdiff_t pos);
+        using Entry = void (*)(unsigned char *cell, PutFn put, GetFn get, GrowFn grow, const TapeNS::Bounds *bounds);
+
+        struct Code
+        {
+            void *mem;
+            size_t size;
+            Entry entry;
+        };
+
+        struct Emitter
+        {
+            std::vector<unsigned char> buf;
+
+            void bytes(std::initializer_list<unsigned char> bs)
+            {
+                buf.insert(buf.end(), bs);
+            }
+
+            void imm32(int v)
+            {
+                for (int i = 0; i < 4; i++)
+                    buf.push_back((unsigned char)((unsigned)v >> (8 * i)));
+            }
+
+            void patch32(size_t at, int v)
+            {
+                for (int i = 0; i < 4; i++)
+                    buf[at + i] = (unsigned char)((unsigned)v >> (8 * i));
+            }
+        };
+
+        // rbx holds the memory head, r12 the output and r13 the input
+        // callback, r14 TapeNS::Grow and r15 the tape bounds. Five pushes
+        // keep the stack 16-byte aligned for calls.
+        static bool Compile(const std::vector<Op> &ops, Code &code)
+        {
+            Emitter e;
+            std::vector<size_t> open;
+
+            e.bytes({0x53});             // push rbx
+            e.bytes({0x41, 0x54});       // push r12
+            e.bytes({0x41, 0x55});       // push r13
+            e.bytes({0x41, 0x56});       // push r14
+            e.bytes({0x41, 0x57});       // push r15
+            e.bytes({0x48, 0x89, 0xFB}); // mov rbx, rdi
+            e.bytes({0x49, 0x89, 0xF4}); // mov r12, rsi
+            e.bytes({0x49, 0x89, 0xD5}); // mov r13, rdx
+            e.bytes({0x49, 0x89, 0xCE}); // mov r14, rcx
+            e.bytes({0x4D, 0x89, 0xC7}); // mov r15, r8
+
+            for (const Op &op : ops)
+            {
+                switch (op.kind)
+                {
+                case OpKind::Add:
+                    e.bytes({0x80, 0x03, (unsigned char)op.arg}); // add byte [rbx], imm8
+                    break;
+                case OpKind::Move:
+                    e.bytes({0x48, 0x81, 0xC3}); // add rbx, imm32
+                    e.imm32(op.arg);
+                    e.bytes({0x49, 0x3B, 0x1F});       // cmp rbx, [r15]
+                    e.bytes({0x72, 0x06});             // jb grow
+                    e.bytes({0x49, 0x3B, 0x5F, 0x08}); // cmp rbx, [r15 + 8]
+                    e.bytes({0x72, 0x0C});             // jb done
+                    e.bytes({0x48, 0x89, 0xDF});       // grow: mov rdi, rbx
+                    e.bytes({0x49, 0x2B, 0x3F});       // sub rdi, [r15]
+                    e.bytes({0x41, 0xFF, 0xD6});       // call r14
+                    e.bytes({0x48, 0x89, 0xC3});       // mov rbx, rax
+                    break;                             // done:
+                case OpKind::Clear:
+                    e.bytes({0xC6, 0x03, 0x00}); // mov byte [rbx], 0
+                    break;
+                case OpKind::Print:
+                    e.bytes({0x0F, 0xB6, 0x3B}); // movzx edi, byte [rbx]
+                    e.bytes({0x41, 0xFF, 0xD4}); // call r12
+                    break;
+                case OpKind::Read:
+                    e.bytes({0x41, 0xFF, 0xD5}); // call r13
+                    e.bytes({0x88, 0x03});       // mov byte [rbx], al
+                    break;
+                case OpKind::Open:
+                    e.bytes({0x80, 0x3B, 0x00}); // cmp byte [rbx], 0
+                    e.bytes({0x0F, 0x84});       // je rel32, patched by Close
+                    e.imm32(0);
+                    open.push_back(e.buf.size());
+                    break;
+                case OpKind::Close:
+                {
+                    size_t body = open.back();
+                    open.pop_back();
+                    e.bytes({0x80, 0x3B, 0x00}); // cmp byte [rbx], 0
+                    e.bytes({0x0F, 0x85});       // jne rel32
+                    e.imm32((int)(body - (e.buf.size() + 4)));
+                    e.patch32(body - 4, (int)(e.buf.size() - body));
+                    break;
+                }
+                }
+            }
+
+            e.bytes({0x41, 0x5F}); // pop r15
+            e.bytes({0x41, 0x5E}); // pop r14
+            e.bytes({0x41, 0x5D}); // pop r13
+            e.bytes({0x41, 0x5C}); // pop r12
+            e.bytes({0x5B});       // pop rbx
+            e.bytes({0xC3});       // ret
+
+            void *mem = mmap(nullptr, e.buf.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mem == MAP_FAILED)
+                return false;
+            memcpy(mem, e.buf.data(), e.buf.size());
+            if (mprotect(mem, e.buf.size(), PROT_READ | PROT_EXEC) != 0)
+            {
+                munmap(mem, e.buf.size());
+                return false;
+            }
+
+            code = {mem, e.buf.size(), (Entry)mem};
+            return true;
+        }
+
+        static void Release(Code &code)
+        {
+            munmap(code.mem, code.size);
+        }
+    } // namespace JitNS
+#endif
+
+    // Runs the program through the JIT when allowed and available, otherwise
+    // through the interpreter. ',' reads from input when given, stdin
+    // otherwise.
+    static int Execute(const char *src, size_t len, bool useJit, const FileNS::File *input)
+    {
+        std::vector<Op> ops;
+        switch (Parse(src, len, ops))
+        {
+        case ParseResult::Ok:
+            break;
+        case ParseResult::Unmatched:
+            printf("Error!\n");
+            return 1;
+        case ParseResult::TooLarge:
+            fprintf(stderr, "Program too large (more than %zu ops)\n", MaxOps);
+            return 1;
+        }
+
+        if (input != nullptr)
+        {
+            IoNS::ResetInput();
+            IoNS::UseInput(*input);
+        }
+
+        unsigned char *cell = TapeNS::Init();
+
+        bool jitted = false;
+#ifdef BF_HAS_JIT
+        JitNS::Code code;
+        if (useJit && JitNS::Compile(ops, code))
+        {
+            code.entry(cell, IoNS::PutByte, IoNS::GetByte, TapeNS::Grow, &TapeNS::bounds);
+            JitNS::Release(code);
+            jitted = true;
+        }
+#else
+        (void)useJit;
+#endif
+        if (!jitted)
+            Interpret(ops, cell, IoNS::PutByte, IoNS::GetByte);
+
+        IoNS::Flush();
+        if (input != nullptr)
+            IoNS::ResetInput();
+        return 0;
+    }
+
+    // Like Execute, with ',' reading from the file at inputPath when given.
+    static int Run(const char *src, size_t len, bool useJit, const char *inputPath)
+    {
+        if (inputPath == nullptr)
+            return Execute(src, len, useJit, nullptr);
+
+        FileNS::File input;
+        if (!FileNS::Open(inputPath, input, true))
+        {
+            fprintf(stderr, "Cannot open input '%s'\n", inputPath);
+            return 1;
+        }
+        int res = Execute(src, len, useJit, &input);
+        FileNS::Close(input);
+        IoNS::ResetInput();
+        return res;
+    }
+
+    static int RunFile(const char *path, bool useJit, const char *inputPath)
+    {
+        FileNS::File prg;
+        if (!FileNS::Open(path, prg, false))
+        {
+            fprintf(stderr, "Cannot open program '%s'\n", path);
+            return 1;
+        }
+        int res = Run(prg.data, prg.size, useJit, inputPath);
+        FileNS::Close(prg);
+        return res;
+    }
+} // namespace RuntimeNS
+
+//////////////////////////////////////////////////////////////////////////////
+
 int main(int argc, char **argv)
 {
+    if (argc == 3 || argc == 4)
+    {
+        const char *input = argc == 4 ? argv[3] : nullptr;
+        if (strcmp(argv[1], "--run") == 0 || strcmp(argv[1], "--interpret") == 0)
+        {
+            return RuntimeNS::Run(argv[2], strlen(argv[2]), strcmp(argv[1], "--run") == 0, input);
+        }
+        if (strcmp(argv[1], "--run-file") == 0 || strcmp(argv[1], "--interpret-file") == 0)
+        {
+            return RuntimeNS::RunFile(argv[2], strcmp(argv[1], "--run-file") == 0, input);
+        }
+    }
+
     if (argc == 2)
     {
         int i = 0;
@@ -692,5 +1442,57 @@ int main(int argc, char **argv)
         using initMachine = typename InitMachine<'[','+','[','+','+',']','-'>::type;
         printf("\nMachine (Errors):\n------------\n%s\n------------\n", MachineExecuter<initMachine>::asDBGTape::cstr);
     }
+
+    {
+        const char *prg = "++++++++[>++++[>++>+++>+++>+<<<<-]>+>+>->>+[<]<-]>>.>---.+++++++..+++.>>.<-.<.+++.------.--------.>>+.>++.";
+        for (bool useJit : {true, false})
+        {
+            printf("\nRuntime %s (Prints 'Hello World!'):\n------------\n", useJit ? "--run" : "--interpret");
+            RuntimeNS::Run(prg, strlen(prg), useJit, nullptr);
+            printf("\n------------\n");
+        }
+    }
+
+    {
+        const char *prg = "+++[->+++[->++++<]<]>>.>+++[->+++[->+++[->++<]<]<]>>>.";
+        for (bool useJit : {true, false})
+        {
+            printf("\nRuntime %s (Prints:'$6'):\n------------\n", useJit ? "--run" : "--interpret");
+            RuntimeNS::Run(prg, strlen(prg), useJit, nullptr);
+            printf("\n------------\n");
+        }
+    }
+
+    {
+        const char *prg = "+[++>]<]";
+        for (bool useJit : {true, false})
+        {
+            printf("\nRuntime %s (Errors):\n------------\n", useJit ? "--run" : "--interpret");
+            RuntimeNS::Run(prg, strlen(prg), useJit, nullptr);
+            printf("\n------------\n");
+        }
+    }
+
+    {
+        const char *prg = "[+[++]-";
+        for (bool useJit : {true, false})
+        {
+            printf("\nRuntime %s (Errors):\n------------\n", useJit ? "--run" : "--interpret");
+            RuntimeNS::Run(prg, strlen(prg), useJit, nullptr);
+            printf("\n------------\n");
+        }
+    }
+
+    {
+        const char *prg = ",[.,]+,++++++++++++++++++++++++++++++++++++++++++++++++.";
+        RuntimeNS::FileNS::File input;
+        RuntimeNS::FileNS::FromMemory("abc", 3, input);
+        for (bool useJit : {true, false})
+        {
+            printf("\nRuntime %s (Echoes input 'abc', then ',' at EOF reads 0 and prints '0'):\n------------\n", useJit ? "--run" : "--interpret");
+            RuntimeNS::Execute(prg, strlen(prg), useJit, &input);
+            printf("\n------------\n");
+        }
+    }
 }
 